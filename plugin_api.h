@@ -0,0 +1,70 @@
+/**
+ * ============================================================================
+ * Plugin ABI shared between the server and its plugins
+ * ============================================================================
+ * Exports looked up in every plugin (only init and one of process/filter
+ * are required):
+ *
+ *   void plugin_init(void* context);
+ *   void plugin_process(const char* data, void* thread_context);
+ *   void plugin_filter(ResponseChain* chain, void* thread_context);
+ *   void* plugin_thread_init(void);
+ *   void plugin_thread_fini(void* thread_context);
+ *   const char* plugin_routes(void);
+ *   unsigned int plugin_time_budget_us(void);
+ *   int plugin_abi_version(void);
+ * ============================================================================
+ */
+
+#ifndef PLUGIN_API_H
+#define PLUGIN_API_H
+
+#include <stddef.h>
+
+#define PLUGIN_ABI_VERSION 1
+#define PLUGIN_SYMBOL_VERSION "PLUGIN_1"
+
+#ifdef _WIN32
+#define PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+// RESPONSE FILTER CHAIN
+// A response is a list of segments that point at bytes owned elsewhere
+// (string literals, the cache, the request buffer). Filters rewrite the
+// response by editing the list, never the bytes, and the server sends the
+// final list with a single vectored write. Data handed to the chain must
+// stay valid until the response is sent: use literals, plugin-owned
+// memory, or memory from alloc(), which is released after the send.
+typedef struct ResponseSegment {
+    const char *data;
+    size_t length;
+    struct ResponseSegment *next;
+} ResponseSegment;
+
+typedef struct ResponseChain ResponseChain;
+
+typedef struct {
+    // Add a segment at the start or end of the body
+    ResponseSegment* (*prepend)(ResponseChain *chain, const char *data, size_t length);
+    ResponseSegment* (*append)(ResponseChain *chain, const char *data, size_t length);
+    // Add a header line (including its trailing "\r\n") after the existing headers
+    ResponseSegment* (*add_header)(ResponseChain *chain, const char *line, size_t length);
+    ResponseSegment* (*insert_after)(ResponseChain *chain, ResponseSegment *segment, const char *data, size_t length);
+    void (*replace)(ResponseChain *chain, ResponseSegment *segment, const char *data, size_t length);
+    void (*remove)(ResponseChain *chain, ResponseSegment *segment);
+    // Scratch memory that lives until the response has been sent
+    char* (*alloc)(ResponseChain *chain, size_t length);
+} ResponseChainOps;
+
+// Segment functions return NULL when the chain is out of segments
+struct ResponseChain {
+    const ResponseChainOps *ops;
+    const char *request;
+    ResponseSegment *head;
+    // Blank line that ends the headers; the body follows it
+    ResponseSegment *header_end;
+};
+
+#endif